@@ -3,6 +3,11 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
+#include <string>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
 
 /**
  * @brief Applies Gaussian blur using separable 2-pass convolution
@@ -433,3 +438,367 @@ emscripten::val adjustSaturation(emscripten::val imageData, int width, int heigh
 
   return result;
 }
+
+/**
+ * @brief Reconstruction kernels supported by the resampler
+ */
+enum class ResampleFilter
+{
+  Box,
+  Mitchell,
+  Lanczos3
+};
+
+/**
+ * @brief Maps filter name ("lanczos3", "mitchell", "box") to kernel, defaults to Lanczos-3
+ */
+static ResampleFilter parseResampleFilter(const std::string &filter)
+{
+  if (filter == "box")
+  {
+    return ResampleFilter::Box;
+  }
+  else if (filter == "mitchell")
+  {
+    return ResampleFilter::Mitchell;
+  }
+
+  return ResampleFilter::Lanczos3;
+}
+
+/**
+ * @brief Kernel support radius in source pixels at scale 1
+ */
+static float resampleFilterSupport(ResampleFilter filter)
+{
+  switch (filter)
+  {
+  case ResampleFilter::Mitchell:
+    return 2.0f;
+  default:
+    return 3.0f;
+  }
+}
+
+/**
+ * @brief Evaluates reconstruction kernel at distance x
+ *
+ * Mitchell-Netravali: cubic with B = C = 1/3
+ * Lanczos-3: sinc(x) × sinc(x/3) for |x| < 3
+ */
+static float resampleFilterWeight(ResampleFilter filter, float x)
+{
+  const float pi = 3.14159265358979f;
+
+  switch (filter)
+  {
+  case ResampleFilter::Mitchell:
+  {
+    const float B = 1.0f / 3.0f;
+    const float C = 1.0f / 3.0f;
+    x = std::fabs(x);
+
+    if (x < 1.0f)
+    {
+      return ((12.0f - 9.0f * B - 6.0f * C) * x * x * x + (-18.0f + 12.0f * B + 6.0f * C) * x * x + (6.0f - 2.0f * B)) / 6.0f;
+    }
+    if (x < 2.0f)
+    {
+      return ((-B - 6.0f * C) * x * x * x + (6.0f * B + 30.0f * C) * x * x + (-12.0f * B - 48.0f * C) * x + (8.0f * B + 24.0f * C)) / 6.0f;
+    }
+    return 0.0f;
+  }
+
+  default:
+  {
+    x = std::fabs(x);
+
+    if (x < 1e-6f)
+    {
+      return 1.0f;
+    }
+    if (x >= 3.0f)
+    {
+      return 0.0f;
+    }
+
+    float px = pi * x;
+    return 3.0f * std::sin(px) * std::sin(px / 3.0f) / (px * px);
+  }
+  }
+}
+
+/**
+ * @brief Precomputed per-output-pixel contribution table for one axis
+ *
+ * Output pixel i reads `windowSize` source pixels starting at start[i],
+ * weighted by weights[i × windowSize + k]. Windows near the border are
+ * shifted inwards and zero-padded so every row of the table has equal length.
+ */
+struct ResampleWeights
+{
+  int windowSize;
+  std::vector<int> start;
+  std::vector<float> weights;
+};
+
+/**
+ * @brief Builds box (area-average) weight table mapping inSize source pixels onto outSize
+ *
+ * Output pixel i covers source span [i × scale, (i+1) × scale); each source
+ * pixel is weighted by the length of its overlap with that span, so partial
+ * pixels at non-integer ratios contribute proportionally and the result is
+ * mirror-symmetric.
+ */
+static ResampleWeights buildBoxWeights(int inSize, int outSize)
+{
+  double scale = static_cast<double>(inSize) / outSize;
+
+  ResampleWeights table;
+  table.windowSize = std::min(inSize, static_cast<int>(std::ceil(scale)) + 1);
+  table.start.resize(outSize);
+  table.weights.assign(static_cast<size_t>(outSize) * table.windowSize, 0.0f);
+
+  for (int i = 0; i < outSize; ++i)
+  {
+    double left = i * scale;
+    double right = (i + 1) * scale;
+    int first = std::max(0, std::min(static_cast<int>(std::floor(left)), inSize - table.windowSize));
+
+    float *row = &table.weights[static_cast<size_t>(i) * table.windowSize];
+
+    for (int k = 0; k < table.windowSize; ++k)
+    {
+      int sx = first + k;
+      double overlap = std::min<double>(sx + 1, right) - std::max<double>(sx, left);
+      row[k] = overlap > 0.0 ? static_cast<float>(overlap / scale) : 0.0f;
+    }
+
+    table.start[i] = first;
+  }
+
+  return table;
+}
+
+/**
+ * @brief Builds normalized weight table mapping inSize source pixels onto outSize
+ *
+ * When downscaling the kernel is stretched by inSize/outSize so it acts as
+ * a low-pass filter; when upscaling it keeps its natural width. Box uses
+ * exact pixel coverage instead, see buildBoxWeights.
+ */
+static ResampleWeights buildResampleWeights(ResampleFilter filter, int inSize, int outSize)
+{
+  if (filter == ResampleFilter::Box)
+  {
+    return buildBoxWeights(inSize, outSize);
+  }
+
+  float scale = static_cast<float>(inSize) / outSize;
+  float filterScale = std::max(1.0f, scale);
+  float support = resampleFilterSupport(filter) * filterScale;
+
+  ResampleWeights table;
+  table.windowSize = std::min(inSize, static_cast<int>(std::ceil(support)) * 2 + 1);
+  table.start.resize(outSize);
+  table.weights.assign(static_cast<size_t>(outSize) * table.windowSize, 0.0f);
+
+  for (int i = 0; i < outSize; ++i)
+  {
+    float center = (i + 0.5f) * scale;
+    int first = std::max(0, static_cast<int>(std::floor(center - support + 0.5f)));
+    int last = std::min(inSize, static_cast<int>(std::floor(center + support + 0.5f)));
+    first = std::max(0, std::min(first, inSize - table.windowSize));
+
+    float *row = &table.weights[static_cast<size_t>(i) * table.windowSize];
+    float weightSum = 0.0f;
+
+    for (int k = 0; k < table.windowSize; ++k)
+    {
+      int sx = first + k;
+      if (sx >= last)
+      {
+        break;
+      }
+
+      float weight = resampleFilterWeight(filter, (sx + 0.5f - center) / filterScale);
+      row[k] = weight;
+      weightSum += weight;
+    }
+
+    if (weightSum == 0.0f)
+    {
+      int nearest = std::max(0, std::min(inSize - 1, static_cast<int>(center))) - first;
+      row[std::max(0, std::min(table.windowSize - 1, nearest))] = 1.0f;
+      weightSum = 1.0f;
+    }
+
+    for (int k = 0; k < table.windowSize; ++k)
+    {
+      row[k] /= weightSum;
+    }
+
+    table.start[i] = first;
+  }
+
+  return table;
+}
+
+/**
+ * @brief Filters one source row horizontally into a float output row
+ *
+ * Source row is first converted to premultiplied float RGBA in sourceRow so
+ * transparent pixels do not bleed their color into neighbours.
+ *
+ * @param src Source RGBA row (width × 4 bytes)
+ * @param width Width of the source row in pixels
+ * @param columns Horizontal weight table, one entry per output pixel
+ * @param sourceRow Scratch buffer of width × 4 floats
+ * @param dst Output row of columns.start.size() × 4 premultiplied floats
+ */
+static void resampleRowHorizontal(const uint8_t *src, int width, const ResampleWeights &columns, float *sourceRow, float *dst)
+{
+  for (int x = 0; x < width; ++x)
+  {
+    float alpha = src[x * 4 + 3] / 255.0f;
+    sourceRow[x * 4] = src[x * 4] * alpha;
+    sourceRow[x * 4 + 1] = src[x * 4 + 1] * alpha;
+    sourceRow[x * 4 + 2] = src[x * 4 + 2] * alpha;
+    sourceRow[x * 4 + 3] = src[x * 4 + 3];
+  }
+
+  for (int x = 0; x < static_cast<int>(columns.start.size()); ++x)
+  {
+    const float *in = &sourceRow[columns.start[x] * 4];
+    const float *weight = &columns.weights[static_cast<size_t>(x) * columns.windowSize];
+
+#ifdef __wasm_simd128__
+    v128_t total = wasm_f32x4_splat(0.0f);
+    for (int k = 0; k < columns.windowSize; ++k)
+    {
+      total = wasm_f32x4_add(total, wasm_f32x4_mul(wasm_v128_load(in + k * 4), wasm_f32x4_splat(weight[k])));
+    }
+    wasm_v128_store(dst + x * 4, total);
+#else
+    float totalR = 0.0f, totalG = 0.0f, totalB = 0.0f, totalA = 0.0f;
+    for (int k = 0; k < columns.windowSize; ++k)
+    {
+      totalR += in[k * 4] * weight[k];
+      totalG += in[k * 4 + 1] * weight[k];
+      totalB += in[k * 4 + 2] * weight[k];
+      totalA += in[k * 4 + 3] * weight[k];
+    }
+    dst[x * 4] = totalR;
+    dst[x * 4 + 1] = totalG;
+    dst[x * 4 + 2] = totalB;
+    dst[x * 4 + 3] = totalA;
+#endif
+  }
+}
+
+/**
+ * @brief Resamples raw RGBA pixels to targetWidth×targetHeight with separable 2-pass filter
+ *
+ * Source rows are filtered horizontally on demand into a ring of
+ * rows.windowSize float rows, so the intermediate never holds more than one
+ * vertical kernel window. Each output row accumulates its window from the
+ * ring, then is unpremultiplied and rounded half to even, matching
+ * wasm_f32x4_nearest so SIMD and scalar builds produce identical bytes.
+ * With -msimd128 each RGBA pixel is processed as a single f32x4 lane group.
+ *
+ * @param pixels Source RGBA pixel data (width × height × 4 bytes)
+ * @param width Width of the source image in pixels
+ * @param height Height of the source image in pixels
+ * @param targetWidth Width of the output image in pixels
+ * @param targetHeight Height of the output image in pixels
+ * @param filter Filter name ("lanczos3", "mitchell", "box")
+ * @return Resampled RGBA pixel data (targetWidth × targetHeight × 4 bytes), empty if pixels is smaller than width × height × 4
+ */
+std::vector<uint8_t> resamplePixels(const std::vector<uint8_t> &pixels, int width, int height, int targetWidth, int targetHeight, const std::string &filter)
+{
+  if (width <= 0 || height <= 0 || targetWidth <= 0 || targetHeight <= 0 || pixels.size() < static_cast<size_t>(width) * height * 4)
+  {
+    return std::vector<uint8_t>();
+  }
+
+  ResampleFilter kernel = parseResampleFilter(filter);
+  ResampleWeights columns = buildResampleWeights(kernel, width, targetWidth);
+  ResampleWeights rows = buildResampleWeights(kernel, height, targetHeight);
+
+  int rowStride = targetWidth * 4;
+  std::vector<float> sourceRow(static_cast<size_t>(width) * 4);
+  std::vector<float> ringRows(static_cast<size_t>(rows.windowSize) * rowStride);
+  std::vector<float> accumRow(rowStride);
+  std::vector<uint8_t> outputData(static_cast<size_t>(targetHeight) * rowStride);
+  int nextSourceRow = 0;
+
+  for (int y = 0; y < targetHeight; ++y)
+  {
+    const float *weight = &rows.weights[static_cast<size_t>(y) * rows.windowSize];
+    std::fill(accumRow.begin(), accumRow.end(), 0.0f);
+
+    nextSourceRow = std::max(nextSourceRow, rows.start[y]);
+    for (; nextSourceRow < rows.start[y] + rows.windowSize; ++nextSourceRow)
+    {
+      resampleRowHorizontal(&pixels[static_cast<size_t>(nextSourceRow) * width * 4], width, columns, sourceRow.data(), &ringRows[static_cast<size_t>(nextSourceRow % rows.windowSize) * rowStride]);
+    }
+
+    for (int k = 0; k < rows.windowSize; ++k)
+    {
+      if (weight[k] == 0.0f)
+      {
+        continue;
+      }
+
+      const float *in = &ringRows[static_cast<size_t>((rows.start[y] + k) % rows.windowSize) * rowStride];
+
+#ifdef __wasm_simd128__
+      v128_t w = wasm_f32x4_splat(weight[k]);
+      for (int i = 0; i < rowStride; i += 4)
+      {
+        wasm_v128_store(&accumRow[i], wasm_f32x4_add(wasm_v128_load(&accumRow[i]), wasm_f32x4_mul(wasm_v128_load(in + i), w)));
+      }
+#else
+      for (int i = 0; i < rowStride; ++i)
+      {
+        accumRow[i] += in[i] * weight[k];
+      }
+#endif
+    }
+
+    uint8_t *out = &outputData[static_cast<size_t>(y) * rowStride];
+
+#ifdef __wasm_simd128__
+    const v128_t zero = wasm_f32x4_splat(0.0f);
+    const v128_t one = wasm_f32x4_splat(1.0f);
+    const v128_t alphaLane = wasm_i32x4_make(0, 0, 0, -1);
+
+    for (int x = 0; x < targetWidth; ++x)
+    {
+      v128_t pixel = wasm_v128_load(&accumRow[x * 4]);
+      v128_t alpha = wasm_i32x4_shuffle(pixel, pixel, 3, 3, 3, 3);
+      v128_t factor = wasm_f32x4_div(wasm_f32x4_splat(255.0f), wasm_f32x4_max(alpha, one));
+      factor = wasm_v128_and(factor, wasm_f32x4_gt(alpha, zero));
+      factor = wasm_v128_bitselect(one, factor, alphaLane);
+
+      v128_t rounded = wasm_i32x4_trunc_sat_f32x4(wasm_f32x4_nearest(wasm_f32x4_mul(pixel, factor)));
+      v128_t narrowed = wasm_i16x8_narrow_i32x4(rounded, rounded);
+      narrowed = wasm_u8x16_narrow_i16x8(narrowed, narrowed);
+      wasm_v128_store32_lane(out + x * 4, narrowed, 0);
+    }
+#else
+    for (int x = 0; x < targetWidth; ++x)
+    {
+      float alpha = accumRow[x * 4 + 3];
+      float factor = alpha > 0.0f ? 255.0f / std::max(alpha, 1.0f) : 0.0f;
+
+      out[x * 4] = static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, std::nearbyint(accumRow[x * 4] * factor))));
+      out[x * 4 + 1] = static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, std::nearbyint(accumRow[x * 4 + 1] * factor))));
+      out[x * 4 + 2] = static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, std::nearbyint(accumRow[x * 4 + 2] * factor))));
+      out[x * 4 + 3] = static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, std::nearbyint(alpha))));
+    }
+#endif
+  }
+
+  return outputData;
+}
@@ -1,4 +1,5 @@
 #include <emscripten/bind.h>
+#include <emscripten/emscripten.h>
 #include <emscripten/val.h>
 #include <vector>
 #include <string>
@@ -18,6 +19,7 @@ extern emscripten::val convertToMonochrome(emscripten::val imageData, int width,
 extern emscripten::val applyBlur(emscripten::val imageData, int width, int height, float blurRadius);
 extern emscripten::val applySharpen(emscripten::val imageData, int width, int height, float sharpenAmount);
 extern emscripten::val applyPixelate(emscripten::val imageData, int width, int height, int pixelSize);
+extern std::vector<uint8_t> resamplePixels(const std::vector<uint8_t> &pixels, int width, int height, int targetWidth, int targetHeight, const std::string &filter);
 
 /**
  * @brief Processes image with all filters and adjustments from canvas
@@ -193,3 +195,186 @@ std::string getPreviewDataUrl(emscripten::val canvas, const std::string &format,
 
   return canvas.call<std::string>("toDataURL", std::string("image/png"));
 }
+
+/**
+ * @brief Creates a new canvas holding raw RGBA pixels
+ * @param pixels RGBA pixel data (width × height × 4 bytes)
+ * @param width Width of the canvas in pixels
+ * @param height Height of the canvas in pixels
+ * @return HTML Canvas element with pixels drawn at (0, 0)
+ */
+static emscripten::val createCanvasFromPixels(const std::vector<uint8_t> &pixels, int width, int height)
+{
+  emscripten::val document = emscripten::val::global("document");
+  emscripten::val canvas = document.call<emscripten::val>("createElement", std::string("canvas"));
+  canvas.set("width", width);
+  canvas.set("height", height);
+
+  emscripten::val ImageDataConstructor = emscripten::val::global("ImageData");
+  emscripten::val uint8Array = emscripten::val::global("Uint8ClampedArray").new_(emscripten::typed_memory_view(pixels.size(), pixels.data()));
+  emscripten::val imageData = ImageDataConstructor.new_(uint8Array, width, height);
+
+  canvas.call<emscripten::val>("getContext", std::string("2d")).call<void>("putImageData", imageData, 0, 0);
+
+  return canvas;
+}
+
+/**
+ * @brief Reads all RGBA pixels of a canvas into WASM memory
+ * @param canvas HTML Canvas element
+ * @return RGBA pixel data (width × height × 4 bytes)
+ */
+static std::vector<uint8_t> readCanvasPixels(emscripten::val canvas)
+{
+  emscripten::val ctx = canvas.call<emscripten::val>("getContext", std::string("2d"));
+  int width = canvas["width"].as<int>();
+  int height = canvas["height"].as<int>();
+
+  emscripten::val imageData = ctx.call<emscripten::val>("getImageData", 0, 0, width, height);
+  return emscripten::convertJSArrayToNumberVector<uint8_t>(imageData["data"]);
+}
+
+/**
+ * @brief Resamples processed canvas to target size for export
+ *
+ * Result can be passed directly to downloadAsPNG/JPEG/WebP or
+ * getPreviewDataUrl in place of the full-size canvas.
+ *
+ * @param canvas HTML Canvas element containing processed image
+ * @param targetWidth Width of the exported image (≤0 returns original canvas)
+ * @param targetHeight Height of the exported image (≤0 returns original canvas)
+ * @param filter Resampling filter ("lanczos3", "mitchell", "box")
+ * @return New canvas of size targetWidth×targetHeight, or original canvas at native size
+ */
+emscripten::val createScaledCanvas(emscripten::val canvas, int targetWidth, int targetHeight, const std::string &filter)
+{
+  int width = canvas["width"].as<int>();
+  int height = canvas["height"].as<int>();
+
+  if (targetWidth <= 0 || targetHeight <= 0 || (targetWidth == width && targetHeight == height))
+  {
+    return canvas;
+  }
+
+  std::vector<uint8_t> scaledData = resamplePixels(readCanvasPixels(canvas), width, height, targetWidth, targetHeight, filter);
+  if (scaledData.empty())
+  {
+    return canvas;
+  }
+
+  return createCanvasFromPixels(scaledData, targetWidth, targetHeight);
+}
+
+/**
+ * @brief Exports processed canvas at several target sizes using the resampler
+ *
+ * Source pixels are read once and each size is resampled from the same
+ * full-resolution data, so thumbnails never inherit artifacts of a previous
+ * downscale or the browser's drawImage scaling. Entries with non-positive
+ * width or height are rejected with null rather than exported at full size.
+ *
+ * @param canvas HTML Canvas element containing processed image
+ * @param targetSizes Array of { width, height } objects, native size is exported as is
+ * @param filter Resampling filter ("lanczos3", "mitchell", "box")
+ * @param format Image format ("png", "jpeg", "webp")
+ * @param quality Quality for lossy formats (10-100, ignored for PNG)
+ * @return Array with a data URL string (or null for an invalid size) per target size
+ */
+emscripten::val exportScaledImages(emscripten::val canvas, emscripten::val targetSizes, const std::string &filter, const std::string &format, int quality)
+{
+  int width = canvas["width"].as<int>();
+  int height = canvas["height"].as<int>();
+  std::vector<uint8_t> sourceData = readCanvasPixels(canvas);
+
+  emscripten::val result = emscripten::val::array();
+
+  int count = targetSizes["length"].as<int>();
+  for (int i = 0; i < count; ++i)
+  {
+    int targetWidth = targetSizes[i]["width"].as<int>();
+    int targetHeight = targetSizes[i]["height"].as<int>();
+
+    if (targetWidth <= 0 || targetHeight <= 0)
+    {
+      result.call<void>("push", emscripten::val::null());
+      continue;
+    }
+
+    if (targetWidth == width && targetHeight == height)
+    {
+      result.call<void>("push", getPreviewDataUrl(canvas, format, quality));
+      continue;
+    }
+
+    std::vector<uint8_t> scaledData = resamplePixels(sourceData, width, height, targetWidth, targetHeight, filter);
+    if (scaledData.empty())
+    {
+      result.call<void>("push", emscripten::val::null());
+      continue;
+    }
+
+    result.call<void>("push", getPreviewDataUrl(createCanvasFromPixels(scaledData, targetWidth, targetHeight), format, quality));
+  }
+
+  return result;
+}
+
+#ifdef IMAGE_EDITOR_BENCHMARK
+/**
+ * @brief Diagnostic: measures resampler throughput for each filter type
+ *
+ * Resamples a synthetic width×height RGBA gradient to targetWidth×targetHeight
+ * `iterations` times per filter, entirely in WASM memory. Only compiled with
+ * -DIMAGE_EDITOR_BENCHMARK=ON, not part of the shipped module.
+ *
+ * @param width Width of the synthetic source image
+ * @param height Height of the synthetic source image
+ * @param targetWidth Width of the resampled image
+ * @param targetHeight Height of the resampled image
+ * @param iterations Number of runs per filter (≥1)
+ * @return Object keyed by filter name with { msPerRun, megapixelsPerSecond } (source pixels)
+ */
+emscripten::val benchmarkResample(int width, int height, int targetWidth, int targetHeight, int iterations)
+{
+  iterations = std::max(1, iterations);
+  emscripten::val result = emscripten::val::object();
+
+  if (width <= 0 || height <= 0 || targetWidth <= 0 || targetHeight <= 0)
+  {
+    return result;
+  }
+
+  std::vector<uint8_t> sourceData(static_cast<size_t>(width) * height * 4);
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      int index = (y * width + x) * 4;
+      sourceData[index] = static_cast<uint8_t>(x * 255 / std::max(1, width - 1));
+      sourceData[index + 1] = static_cast<uint8_t>(y * 255 / std::max(1, height - 1));
+      sourceData[index + 2] = static_cast<uint8_t>((x ^ y) & 255);
+      sourceData[index + 3] = 255;
+    }
+  }
+
+  const char *filters[] = {"lanczos3", "mitchell", "box"};
+  for (const char *filter : filters)
+  {
+    double start = emscripten_get_now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+      resamplePixels(sourceData, width, height, targetWidth, targetHeight, filter);
+    }
+
+    double msPerRun = (emscripten_get_now() - start) / iterations;
+
+    emscripten::val stats = emscripten::val::object();
+    stats.set("msPerRun", msPerRun);
+    stats.set("megapixelsPerSecond", msPerRun > 0 ? (static_cast<double>(width) * height / 1e6) / (msPerRun / 1000.0) : 0.0);
+    result.set(filter, stats);
+  }
+
+  return result;
+}
+#endif
@@ -13,6 +13,11 @@ extern std::string downloadAsPNG(emscripten::val canvas, const std::string &file
 extern std::string downloadAsJPEG(emscripten::val canvas, const std::string &filename, int quality);
 extern std::string downloadAsWebP(emscripten::val canvas, const std::string &filename, int quality);
 extern std::string getPreviewDataUrl(emscripten::val canvas, const std::string &format, int quality);
+extern emscripten::val createScaledCanvas(emscripten::val canvas, int targetWidth, int targetHeight, const std::string &filter);
+extern emscripten::val exportScaledImages(emscripten::val canvas, emscripten::val targetSizes, const std::string &filter, const std::string &format, int quality);
+#ifdef IMAGE_EDITOR_BENCHMARK
+extern emscripten::val benchmarkResample(int width, int height, int targetWidth, int targetHeight, int iterations);
+#endif
 
 EMSCRIPTEN_BINDINGS(main_module)
 {
@@ -25,4 +30,9 @@ EMSCRIPTEN_BINDINGS(main_module)
   emscripten::function("downloadAsJPEG", &downloadAsJPEG);
   emscripten::function("downloadAsWebP", &downloadAsWebP);
   emscripten::function("getPreviewDataUrl", &getPreviewDataUrl);
+  emscripten::function("createScaledCanvas", &createScaledCanvas);
+  emscripten::function("exportScaledImages", &exportScaledImages);
+#ifdef IMAGE_EDITOR_BENCHMARK
+  emscripten::function("benchmarkResample", &benchmarkResample);
+#endif
 }
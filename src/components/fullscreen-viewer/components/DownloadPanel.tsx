@@ -5,6 +5,8 @@ import { Button } from '@/components/ui/button'
 import { Slider } from '@/components/ui/slider'
 import { Label } from '@/components/ui/label'
 import { Download, Image as ImageIcon } from 'lucide-react'
+import { ExportSize, ResampleFilter } from '../types'
+import { DEFAULT_EXPORT_SIZE, EXPORT_SCALES } from '../constants'
 
 interface DownloadPanelProps {
   onDownload: (format: 'png' | 'jpeg' | 'webp', quality?: number) => void
@@ -16,6 +18,8 @@ interface DownloadPanelProps {
   onFormatChange?: (format: 'png' | 'jpeg' | 'webp') => void
   onJpegQualityChange?: (quality: number) => void
   onWebpQualityChange?: (quality: number) => void
+  exportSize?: ExportSize
+  onExportSizeChange?: (size: ExportSize) => void
 }
 
 export const DownloadPanel = ({
@@ -28,10 +32,13 @@ export const DownloadPanel = ({
   onFormatChange,
   onJpegQualityChange,
   onWebpQualityChange,
+  exportSize: propExportSize,
+  onExportSizeChange,
 }: DownloadPanelProps) => {
   const selectedFormat = propSelectedFormat ?? 'png'
   const jpegQuality = propJpegQuality ?? 90
   const webpQuality = propWebpQuality ?? 90
+  const exportSize = propExportSize ?? DEFAULT_EXPORT_SIZE
 
   const handleFormatChange = (format: 'png' | 'jpeg' | 'webp') => {
     onFormatChange?.(format)
@@ -62,6 +69,19 @@ export const DownloadPanel = ({
     return 'Poor'
   }
 
+  const getFilterDescription = (filter: ResampleFilter) => {
+    switch (filter) {
+      case 'lanczos3':
+        return 'Sharpest, best for photos'
+      case 'mitchell':
+        return 'Smoother, fewer halos around edges'
+      case 'box':
+        return 'Fastest, averages the pixels each output pixel covers'
+      default:
+        return ''
+    }
+  }
+
   const getFormatDescription = (format: string) => {
     switch (format) {
       case 'png':
@@ -114,6 +134,60 @@ export const DownloadPanel = ({
           <p className="text-xs text-muted-foreground">{getFormatDescription(selectedFormat)}</p>
         </div>
 
+        {onExportSizeChange && (
+          <>
+            <div className="space-y-2">
+              <Label className="text-sm font-medium">Size</Label>
+              <div className="flex gap-1">
+                {EXPORT_SCALES.map((scale) => (
+                  <Button
+                    key={scale}
+                    variant={exportSize.scale === scale ? 'default' : 'outline'}
+                    size="sm"
+                    onClick={() => onExportSizeChange?.({ ...exportSize, scale })}
+                    className="flex-1"
+                  >
+                    {scale}%
+                  </Button>
+                ))}
+              </div>
+            </div>
+
+            {exportSize.scale !== 100 && (
+              <div className="space-y-2">
+                <Label className="text-sm font-medium">Resampling</Label>
+                <div className="flex gap-1">
+                  <Button
+                    variant={exportSize.filter === 'lanczos3' ? 'default' : 'outline'}
+                    size="sm"
+                    onClick={() => onExportSizeChange?.({ ...exportSize, filter: 'lanczos3' })}
+                    className="flex-1"
+                  >
+                    Lanczos
+                  </Button>
+                  <Button
+                    variant={exportSize.filter === 'mitchell' ? 'default' : 'outline'}
+                    size="sm"
+                    onClick={() => onExportSizeChange?.({ ...exportSize, filter: 'mitchell' })}
+                    className="flex-1"
+                  >
+                    Mitchell
+                  </Button>
+                  <Button
+                    variant={exportSize.filter === 'box' ? 'default' : 'outline'}
+                    size="sm"
+                    onClick={() => onExportSizeChange?.({ ...exportSize, filter: 'box' })}
+                    className="flex-1"
+                  >
+                    Box
+                  </Button>
+                </div>
+                <p className="text-xs text-muted-foreground">{getFilterDescription(exportSize.filter)}</p>
+              </div>
+            )}
+          </>
+        )}
+
         {selectedFormat === 'jpeg' && (
           <div className="space-y-2">
             <div className="flex items-center justify-between">
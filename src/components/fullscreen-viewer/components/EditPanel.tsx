@@ -4,7 +4,7 @@ import { Button } from '@/components/ui/button'
 import { Separator } from '@/components/ui/separator'
 import { TooltipProvider } from '@/components/ui/tooltip'
 import { Settings } from 'lucide-react'
-import { Position, ImageFilters, ColorAdjustments } from '../types'
+import { Position, ImageFilters, ColorAdjustments, ExportSize } from '../types'
 import { DownloadPanel } from './DownloadPanel'
 import { FiltersSection } from './FiltersSection'
 import { ColorAdjustmentsSection } from './ColorAdjustmentsSection'
@@ -33,6 +33,8 @@ interface EditPanelProps {
   onFormatChange?: (format: 'png' | 'jpeg' | 'webp') => void
   onJpegQualityChange?: (quality: number) => void
   onWebpQualityChange?: (quality: number) => void
+  exportSize?: ExportSize
+  onExportSizeChange?: (size: ExportSize) => void
 }
 
 export const EditPanel = ({
@@ -58,6 +60,8 @@ export const EditPanel = ({
   onFormatChange,
   onJpegQualityChange,
   onWebpQualityChange,
+  exportSize,
+  onExportSizeChange,
 }: EditPanelProps) => {
   if (!showEditPanel) {
     return (
@@ -116,6 +120,8 @@ export const EditPanel = ({
                 onFormatChange={onFormatChange}
                 onJpegQualityChange={onJpegQualityChange}
                 onWebpQualityChange={onWebpQualityChange}
+                exportSize={exportSize}
+                onExportSizeChange={onExportSizeChange}
               />
               <Separator />
             </>
@@ -1,4 +1,4 @@
-import { ImageFilters, ColorAdjustments } from './types'
+import { ImageFilters, ColorAdjustments, ExportSize } from './types'
 
 export const DEFAULT_IMAGE_FILTERS: ImageFilters = {
   blur: 0,
@@ -12,3 +12,10 @@ export const DEFAULT_COLOR_ADJUSTMENTS: ColorAdjustments = {
   contrast: 0,
   saturation: 100,
 }
+
+export const DEFAULT_EXPORT_SIZE: ExportSize = {
+  scale: 100,
+  filter: 'lanczos3',
+}
+
+export const EXPORT_SCALES = [100, 75, 50, 25]
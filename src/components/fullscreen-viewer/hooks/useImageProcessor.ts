@@ -1,21 +1,28 @@
-import { useState, useCallback } from 'react'
+import { useState, useCallback, useRef } from 'react'
 import { useWasm } from '@/contexts/WasmContext'
-import { ImageFilters, ColorAdjustments } from '../types'
+import { ImageFilters, ColorAdjustments, ExportSize } from '../types'
 
 interface ImageDownloadOptions {
   filters: ImageFilters
   colorAdjustments: ColorAdjustments
+  exportSize?: ExportSize
 }
 
 export const useImageProcessor = (originalImageUrl: string | null, imageName?: string) => {
   const [previewUrl, setPreviewUrl] = useState<string | null>(null)
   const [isProcessing, setIsProcessing] = useState(false)
   const { instance } = useWasm()
+  const processedCanvasCache = useRef<{ key: string; canvas: HTMLCanvasElement } | null>(null)
+  const exportCanvasCache = useRef<{ source: HTMLCanvasElement; key: string; canvas: HTMLCanvasElement } | null>(null)
 
   const createProcessedCanvas = useCallback(
     async (options: ImageDownloadOptions): Promise<HTMLCanvasElement | null> => {
       if (!originalImageUrl || !instance) return null
 
+      // Format/quality/size changes reuse the last processed canvas instead of reprocessing
+      const key = JSON.stringify([originalImageUrl, options.filters, options.colorAdjustments])
+      if (processedCanvasCache.current?.key === key) return processedCanvasCache.current.canvas
+
       try {
         const img = new Image()
         img.crossOrigin = 'anonymous'
@@ -44,6 +51,7 @@ export const useImageProcessor = (originalImageUrl: string | null, imageName?: s
           options.filters.pixelate
         )
 
+        processedCanvasCache.current = { key, canvas }
         return canvas
       } catch (error) {
         console.error('Error creating processed canvas:', error)
@@ -53,6 +61,24 @@ export const useImageProcessor = (originalImageUrl: string | null, imageName?: s
     [originalImageUrl, instance]
   )
 
+  const createExportCanvas = useCallback(
+    (canvas: HTMLCanvasElement, exportSize?: ExportSize): HTMLCanvasElement => {
+      if (!exportSize || exportSize.scale === 100) return canvas
+
+      const key = `${exportSize.scale}:${exportSize.filter}`
+      const cached = exportCanvasCache.current
+      if (cached && cached.source === canvas && cached.key === key) return cached.canvas
+
+      const targetWidth = Math.max(1, Math.round((canvas.width * exportSize.scale) / 100))
+      const targetHeight = Math.max(1, Math.round((canvas.height * exportSize.scale) / 100))
+
+      const scaledCanvas = instance.createScaledCanvas(canvas, targetWidth, targetHeight, exportSize.filter)
+      exportCanvasCache.current = { source: canvas, key, canvas: scaledCanvas }
+      return scaledCanvas
+    },
+    [instance]
+  )
+
   const downloadImage = useCallback(
     async (format: 'png' | 'jpeg' | 'webp', options: ImageDownloadOptions, quality?: number) => {
       if (!instance) return
@@ -60,9 +86,10 @@ export const useImageProcessor = (originalImageUrl: string | null, imageName?: s
       setIsProcessing(true)
 
       try {
-        const canvas = await createProcessedCanvas(options)
-        if (!canvas) return
+        const processedCanvas = await createProcessedCanvas(options)
+        if (!processedCanvas) return
 
+        const canvas = createExportCanvas(processedCanvas, options.exportSize)
         const filename = imageName || 'processed-image'
 
         if (format === 'png') {
@@ -78,7 +105,7 @@ export const useImageProcessor = (originalImageUrl: string | null, imageName?: s
         setIsProcessing(false)
       }
     },
-    [instance, createProcessedCanvas, imageName]
+    [instance, createProcessedCanvas, createExportCanvas, imageName]
   )
 
   const updatePreview = useCallback(
@@ -88,9 +115,10 @@ export const useImageProcessor = (originalImageUrl: string | null, imageName?: s
       setIsProcessing(true)
 
       try {
-        const canvas = await createProcessedCanvas(options)
-        if (!canvas) return
+        const processedCanvas = await createProcessedCanvas(options)
+        if (!processedCanvas) return
 
+        const canvas = createExportCanvas(processedCanvas, options.exportSize)
         const previewDataUrl = instance.getPreviewDataUrl(canvas, format, quality)
         setPreviewUrl(previewDataUrl)
       } catch (error) {
@@ -100,7 +128,7 @@ export const useImageProcessor = (originalImageUrl: string | null, imageName?: s
         setIsProcessing(false)
       }
     },
-    [instance, createProcessedCanvas]
+    [instance, createProcessedCanvas, createExportCanvas]
   )
 
   return {
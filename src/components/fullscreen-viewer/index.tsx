@@ -3,6 +3,7 @@
 import { useEffect, useCallback, useState } from 'react'
 import { Button } from '@/components/ui/button'
 import { X, Loader2 } from 'lucide-react'
+import { useWasm } from '@/contexts/WasmContext'
 import { FullscreenImageViewerProps } from './types'
 import { useImageViewer } from './hooks/useImageViewer'
 import { usePanelDrag } from './hooks/usePanelDrag'
@@ -11,8 +12,8 @@ import { useImageProcessor } from './hooks/useImageProcessor'
 import { DebugMenu } from './components/DebugMenu'
 import { EditPanel } from './components/EditPanel'
 import { ImageControls } from './components/ImageControls'
-import { ImageFilters, ColorAdjustments } from './types'
-import { DEFAULT_IMAGE_FILTERS, DEFAULT_COLOR_ADJUSTMENTS } from './constants'
+import { ImageFilters, ColorAdjustments, ExportSize } from './types'
+import { DEFAULT_IMAGE_FILTERS, DEFAULT_COLOR_ADJUSTMENTS, DEFAULT_EXPORT_SIZE } from './constants'
 
 export default function FullscreenImageViewer({ imageUrl, imageName, isOpen, onClose }: FullscreenImageViewerProps) {
   const {
@@ -54,6 +55,10 @@ export default function FullscreenImageViewer({ imageUrl, imageName, isOpen, onC
   const [selectedFormat, setSelectedFormat] = useState<'png' | 'jpeg' | 'webp'>('png')
   const [jpegQuality, setJpegQuality] = useState(90)
   const [webpQuality, setWebpQuality] = useState(90)
+  const [exportSize, setExportSize] = useState<ExportSize>(DEFAULT_EXPORT_SIZE)
+
+  const { instance } = useWasm()
+  const supportsScaledExport = typeof instance?.createScaledCanvas === 'function'
 
   const {
     downloadImage,
@@ -94,16 +99,24 @@ export default function FullscreenImageViewer({ imageUrl, imageName, isOpen, onC
 
   const handleDownload = useCallback(
     (format: 'png' | 'jpeg' | 'webp', quality?: number) => {
-      downloadImage(format, { filters: committedFilters, colorAdjustments: committedColorAdjustments }, quality)
+      downloadImage(
+        format,
+        { filters: committedFilters, colorAdjustments: committedColorAdjustments, exportSize },
+        quality
+      )
     },
-    [downloadImage, committedFilters, committedColorAdjustments]
+    [downloadImage, committedFilters, committedColorAdjustments, exportSize]
   )
 
   const handlePreviewQuality = useCallback(
     (format: 'png' | 'jpeg' | 'webp', quality: number) => {
-      updatePreview(format, quality, { filters: committedFilters, colorAdjustments: committedColorAdjustments })
+      updatePreview(format, quality, {
+        filters: committedFilters,
+        colorAdjustments: committedColorAdjustments,
+        exportSize,
+      })
     },
-    [updatePreview, committedFilters, committedColorAdjustments]
+    [updatePreview, committedFilters, committedColorAdjustments, exportSize]
   )
 
   const getCurrentQuality = useCallback(() => {
@@ -124,6 +137,10 @@ export default function FullscreenImageViewer({ imageUrl, imageName, isOpen, onC
     setWebpQuality(quality)
   }, [])
 
+  const handleExportSizeChange = useCallback((size: ExportSize) => {
+    setExportSize(size)
+  }, [])
+
   const handleKeyDown = useCallback(
     (e: KeyboardEvent) => {
       if (e.key === 'Escape') {
@@ -148,9 +165,10 @@ export default function FullscreenImageViewer({ imageUrl, imageName, isOpen, onC
       updatePreview(selectedFormat, getCurrentQuality(), {
         filters: committedFilters,
         colorAdjustments: committedColorAdjustments,
+        exportSize,
       })
     }
-  }, [committedFilters, committedColorAdjustments])
+  }, [committedFilters, committedColorAdjustments, exportSize])
 
   useEffect(() => {
     if (isOpen) {
@@ -271,6 +289,8 @@ export default function FullscreenImageViewer({ imageUrl, imageName, isOpen, onC
         onFormatChange={handleFormatChange}
         onJpegQualityChange={handleJpegQualityChange}
         onWebpQualityChange={handleWebpQualityChange}
+        exportSize={exportSize}
+        onExportSizeChange={supportsScaledExport ? handleExportSizeChange : undefined}
       />
     </div>
   )
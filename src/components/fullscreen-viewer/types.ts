@@ -23,6 +23,13 @@ export interface ColorAdjustments {
   saturation: number
 }
 
+export type ResampleFilter = 'lanczos3' | 'mitchell' | 'box'
+
+export interface ExportSize {
+  scale: number
+  filter: ResampleFilter
+}
+
 export interface ViewerState {
   scale: number
   position: Position
@@ -10,6 +10,36 @@ interface WasmContextType {
 
 const WasmContext = createContext<WasmContextType | undefined>(undefined)
 
+// Smallest module using a v128 instruction (i8x16.splat + i8x16.popcnt)
+const WASM_SIMD_PROBE = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11,
+])
+
+const supportsWasmSimd = () => {
+  try {
+    return WebAssembly.validate(WASM_SIMD_PROBE)
+  } catch {
+    return false
+  }
+}
+
+// main-simd.js is only produced by the emscripten build (build-wasm.sh), not checked in
+const WASM_SIMD_ENABLED = process.env.NEXT_PUBLIC_WASM_SIMD === '1'
+
+const importWasmModule = async () => {
+  if (WASM_SIMD_ENABLED && supportsWasmSimd()) {
+    try {
+      // @ts-ignore
+      return await import(/* webpackIgnore: true */ '/wasm/main-simd.js')
+    } catch (error) {
+      console.warn('SIMD WASM module unavailable, falling back to baseline build:', error)
+    }
+  }
+
+  // @ts-ignore
+  return await import('@/public/wasm/main.js')
+}
+
 export const useWasm = () => {
   const context = useContext(WasmContext)
   if (context === undefined) {
@@ -30,8 +60,7 @@ export const WasmProvider = ({ children }: WasmProviderProps) => {
   useEffect(() => {
     const loadWasm = async () => {
       try {
-        // @ts-ignore
-        const wasmModule = await import('@/public/wasm/main.js')
+        const wasmModule = await importWasmModule()
         const wasmInstance = await wasmModule.default()
         setInstance(wasmInstance)
         setError(null)